@@ -55,8 +55,8 @@ private:
 
    //------------------------------------
 
-   static const int bufferSize = 47+256;
-   // totals 512 bytes under g++ for igzstream at the end.
+   // 64kB plus the putback area to reduce the number of gzread calls
+   static const int bufferSize = 4 + 65536;
 
    //------------------------------------
    gzFile           file;